@@ -0,0 +1,721 @@
+#include <string>
+#include <vector>
+#include <map>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#if defined(__linux__)
+#include <dirent.h>
+#endif
+
+#if defined(__APPLE__)
+#include <libproc.h>
+#include <mach/mach_time.h>
+#endif
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+// isolate prints this for every EXC_BREAKPOINT it handles (src/mach_exc_handlers.cpp)
+const string g_breakpoint_marker = "[isolate] breakpoint hit";
+
+// isolate doesn't restore the original instruction after a breakpoint, so the
+// thread that hit it re-traps on the same `brk` forever. The rates below
+// therefore measure breakpoint round-trips, not calls of the function.
+const string g_results_note = "breakpoint_traps_per_sec and tracer_cpu_us_per_trap count re-traps on the "
+                              "same brk, since isolate does not step past the breakpoint yet";
+
+// bump whenever metric names or meanings change; baselines from another schema are rejected
+const int g_results_schema = 1;
+
+// kcud1 for TERM=xterm, which is what isolate is run under
+const string g_key_down = "\033OB";
+
+// indices into isolate's g_argument_type_tags
+enum ArgumentTypeTag { I8, I16, I32, I64, U8, U16, U32, U64, FLOAT, DOUBLE };
+
+struct BenchArgument {
+  ArgumentTypeTag type_tag;
+  string value;
+};
+
+struct BenchTarget {
+  string name;
+  vector<BenchArgument> arguments;
+};
+
+// every target exports its function under test as `isolate_bench_entry`
+const vector<BenchTarget> g_bench_targets = {
+  { "leaf_arith", { { I64, "7" }, { I64, "35" } } },
+  { "string_ops", { { U32, "64" } } },
+  { "recursion", { { U32, "24" } } },
+  { "threads", { { U32, "1000" } } },
+  { "heap_graph", { { U64, "0" }, { U32, "4096" } } },
+  { "float_abi", { { FLOAT, "1.5" }, { DOUBLE, "2.25" }, { FLOAT, "3.5" }, { DOUBLE, "4.75" },
+                   { FLOAT, "0.5" }, { DOUBLE, "6.125" }, { FLOAT, "7.25" }, { DOUBLE, "8.5" } } },
+};
+
+struct Metric {
+  const char* name;
+  bool higher_is_better;
+  // aggregate repetitions with the minimum instead of the median; used for
+  // latencies, whose noise is almost all one-sided (scheduling, cold caches)
+  bool use_min;
+  // changes smaller than this (in the metric's unit) never count as a
+  // regression, whatever the relative change
+  double min_delta;
+};
+
+const vector<Metric> g_metrics = {
+  { "first_breakpoint_ms", false, true, 5.0 },
+  { "breakpoint_traps_per_sec", true, false, 100.0 },
+  { "tracer_cpu_us_per_trap", false, false, 2.0 },
+  { "peak_rss_kib", false, false, 1024.0 },
+};
+
+struct Options {
+  string isolate_path;
+  string targets_dir;
+  string output_path;
+  string compare_path;
+  double tolerance = 0.10;
+  int repetitions = 5;
+  double warmup_secs = 0.5;
+  double window_secs = 2.0;
+  double timeout_secs = 10.0;
+};
+
+/**
+ * @brief prints program usage
+ * @param prog_name the name of the program
+ */
+void print_usage(char* prog_name) {
+  cerr << "Usage: " << prog_name << " --isolate /path/to/isolate --targets-dir /path/to/targets\n"
+       << "  [--output results.json] [--compare baseline.json] [--tolerance 0.10]\n"
+       << "  [--repetitions 5] [--warmup seconds] [--window seconds] [--timeout seconds]\n";
+}
+
+/**
+ * @brief looks up the link-time address of `isolate_bench_entry` with nm
+ * @param binary_path the target binary
+ * @return the address, or 0 if the symbol was not found
+ */
+uint64_t find_entry_address(const string& binary_path) {
+  string cmd = "nm '" + binary_path + "' 2>/dev/null";
+  FILE* nm = popen(cmd.c_str(), "r");
+  if (nm == nullptr) {
+    perror("popen");
+    exit(EXIT_FAILURE);
+  }
+
+  uint64_t addr = 0;
+  char line[512];
+  while (fgets(line, sizeof(line), nm) != nullptr) {
+    char addr_str[64], type[8], name[256];
+    if (sscanf(line, "%63s %7s %255s", addr_str, type, name) != 3)
+      continue;
+    // Mach-O prefixes C symbols with an underscore
+    if (strcmp(name, "isolate_bench_entry") == 0 || strcmp(name, "_isolate_bench_entry") == 0) {
+      addr = strtoull(addr_str, nullptr, 16);
+      break;
+    }
+  }
+
+  pclose(nm);
+  return addr;
+}
+
+/**
+ * @brief builds the keystrokes that answer isolate's argument prompts
+ * @param arguments the arguments to enter
+ * @return the bytes to write to isolate's stdin
+ */
+string build_key_script(const vector<BenchArgument>& arguments) {
+  if (arguments.empty())
+    return "\n"; // "Any arguments?" -> No
+
+  string keys = g_key_down + "\n"; // "Any arguments?" -> Yes
+  for (size_t i = 0; i < arguments.size(); i++) {
+    keys += "\n"; // -> Primitive
+    for (int j = 0; j < arguments[i].type_tag; j++)
+      keys += g_key_down;
+    keys += "\n";
+    keys += arguments[i].value + "\n";
+
+    // "Done?" -> Yes only after the last argument
+    if (i + 1 == arguments.size())
+      keys += g_key_down;
+    keys += "\n";
+  }
+  return keys;
+}
+
+/**
+ * @brief returns the CPU time consumed so far by a running process
+ * @param pid the process to sample
+ * @return user + system time in seconds, or a negative value on failure
+ */
+double process_cpu_seconds(pid_t pid) {
+#if defined(__linux__)
+  // schedstat reports on-CPU time in nanoseconds; /proc/<pid>/stat only has
+  // 10ms clock ticks, which is too coarse for a per-trap cost
+  char path[64];
+  snprintf(path, sizeof(path), "/proc/%d/task", pid);
+  DIR* tasks = opendir(path);
+  if (tasks == nullptr)
+    return -1;
+
+  uint64_t cpu_ns = 0;
+  bool found = false;
+  struct dirent* entry;
+  while ((entry = readdir(tasks)) != nullptr) {
+    if (entry->d_name[0] == '.')
+      continue;
+
+    string schedstat_path = string(path) + "/" + entry->d_name + "/schedstat";
+    ifstream schedstat(schedstat_path);
+    uint64_t thread_ns;
+    if (schedstat >> thread_ns) {
+      cpu_ns += thread_ns;
+      found = true;
+    }
+  }
+  closedir(tasks);
+  return found ? cpu_ns / 1e9 : -1;
+#elif defined(__APPLE__)
+  rusage_info_v2 info;
+  if (proc_pid_rusage(pid, RUSAGE_INFO_V2, (rusage_info_t*)&info) != 0)
+    return -1;
+
+  // these are in mach absolute time units, not nanoseconds
+  mach_timebase_info_data_t timebase;
+  mach_timebase_info(&timebase);
+  uint64_t ticks = info.ri_user_time + info.ri_system_time;
+  return (double)ticks * timebase.numer / timebase.denom / 1e9;
+#else
+  return -1;
+#endif
+}
+
+/**
+ * @brief counts occurrences of the breakpoint marker in freshly read output
+ * @param carry output that might hold the start of a marker split across reads
+ * @param data freshly read output
+ * @param len length of @p data
+ * @return the number of complete markers found
+ */
+uint64_t count_markers(string& carry, const char* data, size_t len) {
+  carry.append(data, len);
+  uint64_t count = 0;
+  size_t pos = 0, last_end = 0;
+  while ((pos = carry.find(g_breakpoint_marker, pos)) != string::npos) {
+    count++;
+    pos += g_breakpoint_marker.size();
+    last_end = pos;
+  }
+
+  size_t keep = min(carry.size() - last_end, g_breakpoint_marker.size() - 1);
+  carry.erase(0, carry.size() - keep);
+  return count;
+}
+
+/**
+ * @brief runs isolate against one target once and measures it
+ * @param opts the benchmark options
+ * @param target the target to run
+ * @param binary_path path to the target binary
+ * @param function_addr address of the function under test
+ * @param results receives one value per metric on success
+ * @return an empty string on success, otherwise a description of the failure
+ */
+string run_once(const Options& opts, const BenchTarget& target, const string& binary_path,
+                uint64_t function_addr, map<string, double>& results) {
+  int in_pipe[2], out_pipe[2];
+  if (pipe(in_pipe) < 0 || pipe(out_pipe) < 0) {
+    perror("pipe");
+    exit(EXIT_FAILURE);
+  }
+
+  char addr_str[32];
+  snprintf(addr_str, sizeof(addr_str), "0x%llx", (unsigned long long)function_addr);
+
+  Clock::time_point start = Clock::now();
+  pid_t isolate_pid = fork();
+  if (isolate_pid < 0) {
+    perror("fork");
+    exit(EXIT_FAILURE);
+  }
+
+  if (isolate_pid == 0) {
+    // own process group, so the traced target can be killed along with isolate
+    setpgid(0, 0);
+    dup2(in_pipe[0], STDIN_FILENO);
+    dup2(out_pipe[1], STDOUT_FILENO);
+    dup2(out_pipe[1], STDERR_FILENO);
+    close(in_pipe[0]);
+    close(in_pipe[1]);
+    close(out_pipe[0]);
+    close(out_pipe[1]);
+    setenv("TERM", "xterm", 1);
+
+    const char* argv[] = { opts.isolate_path.c_str(), "--binary", binary_path.c_str(),
+                           "--function-address", addr_str, NULL };
+    execv(opts.isolate_path.c_str(), const_cast<char* const*>(argv));
+    perror("execv");
+    _exit(EXIT_FAILURE);
+  }
+
+  setpgid(isolate_pid, isolate_pid);
+  close(in_pipe[0]);
+  close(out_pipe[1]);
+
+  string keys = build_key_script(target.arguments);
+  if (write(in_pipe[1], keys.data(), keys.size()) != (ssize_t)keys.size())
+    perror("write");
+  close(in_pipe[1]);
+
+  // phases: waiting for the first breakpoint, warming up, measuring
+  string error;
+  string carry;
+  uint64_t traps = 0;
+  uint64_t window_start_traps = 0;
+  double window_start_cpu = 0;
+  Clock::time_point first_break, window_start;
+  bool seen_first_break = false, in_window = false;
+  bool exited = false;
+
+  while (true) {
+    Clock::time_point now = Clock::now();
+    if (!seen_first_break && chrono::duration<double>(now - start).count() > opts.timeout_secs) {
+      error = "no breakpoint within timeout";
+      break;
+    }
+    if (seen_first_break && !in_window &&
+        chrono::duration<double>(now - first_break).count() >= opts.warmup_secs) {
+      in_window = true;
+      window_start = now;
+      window_start_traps = traps;
+      window_start_cpu = process_cpu_seconds(isolate_pid);
+    }
+    if (in_window && chrono::duration<double>(now - window_start).count() >= opts.window_secs) {
+      double elapsed = chrono::duration<double>(now - window_start).count();
+      uint64_t window_traps = traps - window_start_traps;
+      double cpu = process_cpu_seconds(isolate_pid) - window_start_cpu;
+
+      results["first_breakpoint_ms"] = chrono::duration<double, milli>(first_break - start).count();
+      results["breakpoint_traps_per_sec"] = window_traps / elapsed;
+      if (window_traps > 0 && window_start_cpu >= 0 && cpu >= 0)
+        results["tracer_cpu_us_per_trap"] = cpu * 1e6 / window_traps;
+      break;
+    }
+
+    struct pollfd pfd = { out_pipe[0], POLLIN, 0 };
+    if (poll(&pfd, 1, 10) < 0) {
+      if (errno == EINTR)
+        continue;
+      perror("poll");
+      exit(EXIT_FAILURE);
+    }
+    if (!(pfd.revents & (POLLIN | POLLHUP)))
+      continue;
+
+    char buf[4096];
+    ssize_t n = read(out_pipe[0], buf, sizeof(buf));
+    if (n <= 0) {
+      exited = true;
+      error = "isolate exited before the measurement finished";
+      break;
+    }
+
+    uint64_t found = count_markers(carry, buf, n);
+    if (found && !seen_first_break) {
+      seen_first_break = true;
+      first_break = Clock::now();
+    }
+    traps += found;
+  }
+
+  if (!exited)
+    kill(-isolate_pid, SIGKILL);
+  close(out_pipe[0]);
+
+  int status;
+  struct rusage usage;
+  if (wait4(isolate_pid, &status, 0, &usage) < 0) {
+    perror("wait4");
+    exit(EXIT_FAILURE);
+  }
+  // make sure the traced target doesn't outlive isolate
+  kill(-isolate_pid, SIGKILL);
+
+  if (error.empty()) {
+#if defined(__APPLE__)
+    results["peak_rss_kib"] = usage.ru_maxrss / 1024.0; // bytes on macOS
+#else
+    results["peak_rss_kib"] = usage.ru_maxrss;          // KiB on Linux
+#endif
+  }
+  return error;
+}
+
+/**
+ * @brief returns the median of a non-empty set of samples
+ * @param samples the samples
+ * @return the median of @p samples
+ */
+double median(vector<double> samples) {
+  sort(samples.begin(), samples.end());
+  size_t mid = samples.size() / 2;
+  if (samples.size() % 2)
+    return samples[mid];
+  return (samples[mid - 1] + samples[mid]) / 2;
+}
+
+/**
+ * @brief writes benchmark results as JSON
+ * @param out the stream to write to
+ * @param results per target, per metric values
+ * @param opts the options the results were measured with
+ */
+void write_json(ostream& out, const map<string, map<string, double>>& results, const Options& opts) {
+  out << "{\n";
+  out << "  \"schema\": " << g_results_schema << ",\n";
+  out << "  \"note\": \"" << g_results_note << "\",\n";
+  out << "  \"repetitions\": " << opts.repetitions << ",\n";
+  out << "  \"window_secs\": " << opts.window_secs << ",\n";
+  out << "  \"targets\": {";
+  bool first_target = true;
+  for (const BenchTarget& target : g_bench_targets) {
+    auto it = results.find(target.name);
+    if (it == results.end())
+      continue;
+
+    out << (first_target ? "\n" : ",\n") << "    \"" << target.name << "\": {";
+    first_target = false;
+    bool first_metric = true;
+    for (const Metric& metric : g_metrics) {
+      auto value = it->second.find(metric.name);
+      if (value == it->second.end())
+        continue;
+      out << (first_metric ? "\n" : ",\n") << "      \"" << metric.name << "\": " << value->second;
+      first_metric = false;
+    }
+    out << "\n    }";
+  }
+  out << "\n  }\n}\n";
+}
+
+/**
+ * @brief minimal reader for the JSON written by write_json
+ *
+ * Only understands what that function produces: nested objects whose leaves
+ * are numbers or strings. Numeric leaves are flattened into "target.metric"
+ * style keys; string leaves are skipped.
+ */
+class JsonReader {
+ public:
+  JsonReader(const string& text) : text_(text) {}
+
+  bool parse(map<string, double>& out) {
+    skip_ws();
+    return parse_object("", out) && (skip_ws(), pos_ == text_.size());
+  }
+
+ private:
+  const string& text_;
+  size_t pos_ = 0;
+
+  void skip_ws() {
+    while (pos_ < text_.size() && isspace((unsigned char)text_[pos_]))
+      pos_++;
+  }
+
+  bool consume(char c) {
+    skip_ws();
+    if (pos_ < text_.size() && text_[pos_] == c) {
+      pos_++;
+      return true;
+    }
+    return false;
+  }
+
+  bool parse_string(string& s) {
+    if (!consume('"'))
+      return false;
+    size_t end = text_.find('"', pos_);
+    if (end == string::npos)
+      return false;
+    s = text_.substr(pos_, end - pos_);
+    pos_ = end + 1;
+    return true;
+  }
+
+  bool parse_object(const string& prefix, map<string, double>& out) {
+    if (!consume('{'))
+      return false;
+    if (consume('}'))
+      return true;
+
+    do {
+      string key;
+      if (!parse_string(key) || !consume(':'))
+        return false;
+      string path = prefix.empty() ? key : prefix + "." + key;
+
+      skip_ws();
+      if (pos_ < text_.size() && text_[pos_] == '{') {
+        if (!parse_object(path, out))
+          return false;
+      } else if (pos_ < text_.size() && text_[pos_] == '"') {
+        string ignored;
+        if (!parse_string(ignored))
+          return false;
+      } else {
+        const char* begin = text_.c_str() + pos_;
+        char* end;
+        double value = strtod(begin, &end);
+        if (end == begin)
+          return false;
+        pos_ += end - begin;
+        out[path] = value;
+      }
+    } while (consume(','));
+
+    return consume('}');
+  }
+};
+
+/**
+ * @brief reads a baseline file written by a previous run
+ * @param baseline_path the baseline to read
+ * @return the baseline's metrics, flattened into "targets.<target>.<metric>" keys
+ */
+map<string, double> load_baseline(const string& baseline_path) {
+  ifstream in(baseline_path);
+  if (!in) {
+    cerr << "no baseline at " << baseline_path << "; run `make bench-baseline` on the reference machine "
+         << "and commit the result first" << endl;
+    exit(EXIT_FAILURE);
+  }
+  stringstream text;
+  text << in.rdbuf();
+
+  map<string, double> baseline;
+  if (!JsonReader(text.str()).parse(baseline)) {
+    cerr << "malformed baseline " << baseline_path << endl;
+    exit(EXIT_FAILURE);
+  }
+
+  auto schema = baseline.find("schema");
+  if (schema == baseline.end() || schema->second != g_results_schema) {
+    cerr << "baseline " << baseline_path << " has schema "
+         << (schema == baseline.end() ? string("(none)") : to_string((int)schema->second))
+         << ", expected " << g_results_schema << "; regenerate it with `make bench-baseline`" << endl;
+    exit(EXIT_FAILURE);
+  }
+  return baseline;
+}
+
+/**
+ * @brief compares results against a baseline
+ * @param results per target, per metric values
+ * @param baseline the baseline, as returned by load_baseline
+ * @param tolerance allowed relative regression, e.g. 0.10 for 10%; a metric
+ *        also has to move by more than its min_delta to count as regressed
+ * @param missing receives the number of metrics present in only one of
+ *        @p results and @p baseline
+ * @return the number of regressions found
+ */
+int compare_against_baseline(const map<string, map<string, double>>& results,
+                             const map<string, double>& baseline, double tolerance, int& missing) {
+  int regressions = 0;
+  missing = 0;
+  printf("\n%-12s %-30s %14s %14s %9s\n", "target", "metric", "baseline", "current", "change");
+  for (const BenchTarget& target : g_bench_targets) {
+    auto current = results.find(target.name);
+
+    for (const Metric& metric : g_metrics) {
+      auto base = baseline.find("targets." + target.name + "." + metric.name);
+      bool have_base = base != baseline.end();
+      bool have_value = current != results.end() && current->second.count(metric.name);
+      if (!have_base || !have_value) {
+        missing++;
+        printf("%-12s %-30s %14s %14s %9s  MISSING\n", target.name.c_str(), metric.name,
+               have_base ? "" : "-", have_value ? "" : "-", "");
+        continue;
+      }
+
+      double value = current->second.at(metric.name);
+      double delta = value - base->second;
+      double worse = metric.higher_is_better ? -delta : delta;
+      bool regressed = worse > metric.min_delta &&
+                       (base->second == 0 || worse / fabs(base->second) > tolerance);
+      regressions += regressed;
+      printf("%-12s %-30s %14.3f %14.3f %+8.1f%%%s\n", target.name.c_str(), metric.name,
+             base->second, value, base->second ? delta / base->second * 100 : 0.0,
+             regressed ? "  REGRESSED" : "");
+    }
+  }
+  return regressions;
+}
+
+int main(int argc, char* argv[]) {
+  // parse command line args
+  Options opts;
+  {
+    static struct option long_options[] = {
+        {"isolate", required_argument, 0, 'i'},
+        {"targets-dir", required_argument, 0, 't'},
+        {"output", required_argument, 0, 'o'},
+        {"compare", required_argument, 0, 'c'},
+        {"tolerance", required_argument, 0, 'T'},
+        {"repetitions", required_argument, 0, 'r'},
+        {"warmup", required_argument, 0, 'w'},
+        {"window", required_argument, 0, 'W'},
+        {"timeout", required_argument, 0, 's'},
+        {0, 0, 0, 0}
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "i:t:o:c:", long_options, NULL)) != -1) {
+      switch (opt) {
+        case 'i':
+          opts.isolate_path = optarg;
+          break;
+        case 't':
+          opts.targets_dir = optarg;
+          break;
+        case 'o':
+          opts.output_path = optarg;
+          break;
+        case 'c':
+          opts.compare_path = optarg;
+          break;
+        case 'T':
+          opts.tolerance = strtod(optarg, nullptr);
+          break;
+        case 'r':
+          opts.repetitions = atoi(optarg);
+          break;
+        case 'w':
+          opts.warmup_secs = strtod(optarg, nullptr);
+          break;
+        case 'W':
+          opts.window_secs = strtod(optarg, nullptr);
+          break;
+        case 's':
+          opts.timeout_secs = strtod(optarg, nullptr);
+          break;
+        case '?':
+          print_usage(argv[0]);
+          exit(EXIT_FAILURE);
+      }
+    }
+
+    if (opts.isolate_path.empty() || opts.targets_dir.empty() || opts.repetitions < 1 ||
+        opts.window_secs <= 0 || opts.tolerance < 0) {
+      print_usage(argv[0]);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+#if defined(__APPLE__)
+  // isolate needs task_for_pid(), which only works as root; without it every
+  // target would fail with "isolate exited before the measurement finished"
+  if (geteuid() != 0) {
+    cerr << "isolate needs root for task_for_pid() on macOS, run the benchmarks with sudo" << endl;
+    exit(EXIT_FAILURE);
+  }
+#endif
+
+  // check the baseline before spending minutes on measurements
+  map<string, double> baseline;
+  if (!opts.compare_path.empty())
+    baseline = load_baseline(opts.compare_path);
+
+  // a target that makes isolate exit early must not take the driver down with it
+  signal(SIGPIPE, SIG_IGN);
+
+  // run every target, keeping the median (or minimum) of each metric
+  map<string, map<string, double>> results;
+  int failures = 0;
+  for (const BenchTarget& target : g_bench_targets) {
+    string binary_path = opts.targets_dir + "/" + target.name;
+    uint64_t function_addr = find_entry_address(binary_path);
+    if (!function_addr) {
+      cerr << target.name << ": isolate_bench_entry not found in " << binary_path << endl;
+      failures++;
+      continue;
+    }
+
+    map<string, vector<double>> samples;
+    string error;
+    for (int i = 0; i < opts.repetitions && error.empty(); i++) {
+      map<string, double> run;
+      error = run_once(opts, target, binary_path, function_addr, run);
+      for (const auto& kv : run)
+        samples[kv.first].push_back(kv.second);
+    }
+
+    if (!error.empty()) {
+      cerr << target.name << ": " << error << endl;
+      failures++;
+      continue;
+    }
+
+    cout << target.name << ":";
+    for (const Metric& metric : g_metrics) {
+      if (samples.count(metric.name)) {
+        const vector<double>& values = samples[metric.name];
+        results[target.name][metric.name] =
+            metric.use_min ? *min_element(values.begin(), values.end()) : median(values);
+        cout << " " << metric.name << "=" << results[target.name][metric.name];
+      }
+    }
+    cout << endl;
+  }
+
+  // a partial result must never replace a good one, bench-baseline writes
+  // straight to the tracked bench/baseline.json
+  if (!opts.output_path.empty() && failures) {
+    cerr << failures << " target(s) failed, not writing " << opts.output_path << endl;
+  } else if (!opts.output_path.empty()) {
+    ofstream out(opts.output_path);
+    if (!out) {
+      cerr << "cannot write " << opts.output_path << endl;
+      exit(EXIT_FAILURE);
+    }
+    write_json(out, results, opts);
+  }
+
+  if (!opts.compare_path.empty()) {
+    int missing;
+    int regressions = compare_against_baseline(results, baseline, opts.tolerance, missing);
+    if (missing)
+      cerr << missing << " metric(s) missing from the baseline or this run" << endl;
+    if (regressions) {
+      cerr << regressions << " metric(s) regressed by more than " << opts.tolerance * 100
+           << "% and their minimum delta" << endl;
+    }
+    if (missing || regressions)
+      return EXIT_FAILURE;
+  }
+
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
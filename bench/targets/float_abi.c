@@ -0,0 +1,15 @@
+/**
+ * @brief mixes float and double parameters until every floating point
+ *        argument register is in use
+ * @return a combination of all arguments
+ */
+__attribute__((noinline)) double isolate_bench_entry(float a, double b, float c, double d,
+                                                     float e, double f, float g, double h) {
+  return (a * b + c) / (d + 1.0) - (e * f) + (g - h) * 0.5;
+}
+
+int main(void) {
+  volatile double sink = 0;
+  for (float x = 0.0f;; x += 0.25f)
+    sink = isolate_bench_entry(x, 1.5, x * 2.0f, 2.25, 3.5f, x, 0.125f, sink);
+}
@@ -0,0 +1,54 @@
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+const size_t g_num_nodes = 1 << 20;
+const size_t g_edges_per_node = 4;
+
+struct Node {
+  uint64_t value;
+  Node* edges[g_edges_per_node];
+};
+
+vector<Node*> g_nodes;
+
+/**
+ * @brief pointer-chases through a large heap-allocated graph
+ *
+ * isolate doesn't step past the breakpoint yet, so the walk never runs. What
+ * this target exercises today is the setup in main: building ~1M nodes (around
+ * 50 MiB, spread over the heap) before the first call, which shows up in
+ * first_breakpoint_ms, and a large address space for the one trapping thread.
+ * @param start index of the node to start from
+ * @param steps number of edges to follow
+ * @return the sum of visited node values
+ */
+extern "C" __attribute__((noinline)) uint64_t isolate_bench_entry(uint64_t start, uint32_t steps) {
+  Node* node = g_nodes[start % g_nodes.size()];
+  uint64_t sum = 0;
+  for (uint32_t i = 0; i < steps; i++) {
+    sum += node->value;
+    node = node->edges[node->value % g_edges_per_node];
+  }
+  return sum;
+}
+
+int main() {
+  // nodes are allocated one by one (not as an array) so they are spread over the heap
+  g_nodes.reserve(g_num_nodes);
+  for (size_t i = 0; i < g_num_nodes; i++)
+    g_nodes.push_back(new Node{i * 0x9e3779b97f4a7c15ull, {}});
+
+  uint64_t lcg = 88172645463325252ull;
+  for (Node* node : g_nodes) {
+    for (size_t e = 0; e < g_edges_per_node; e++) {
+      lcg = lcg * 6364136223846793005ull + 1442695040888963407ull;
+      node->edges[e] = g_nodes[(lcg >> 33) % g_num_nodes];
+    }
+  }
+
+  volatile uint64_t sink = 0;
+  for (uint64_t i = 0;; i++)
+    sink = isolate_bench_entry(i + sink, 4096);
+}
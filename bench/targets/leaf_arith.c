@@ -0,0 +1,18 @@
+#include <stdint.h>
+
+/**
+ * @brief leaf function with no calls or memory traffic, so the measurement is
+ *        dominated by the breakpoint round-trip itself
+ * @param a first operand
+ * @param b second operand
+ * @return a mix of @p a and @p b
+ */
+__attribute__((noinline)) int64_t isolate_bench_entry(int64_t a, int64_t b) {
+  return a * 31 + (b ^ (a >> 3));
+}
+
+int main(void) {
+  volatile int64_t sink = 0;
+  for (int64_t i = 0;; i++)
+    sink = isolate_bench_entry(i, sink);
+}
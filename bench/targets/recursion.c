@@ -0,0 +1,23 @@
+#include <stdint.h>
+
+/**
+ * @brief naive recursive fibonacci
+ *
+ * isolate doesn't step past the breakpoint yet, so only the outermost call is
+ * ever reached and the recursion never runs. Today this target exercises one
+ * thread, a small address space and no setup before the first call; it is here
+ * so re-entering the breakpoint is covered once isolate can step past it.
+ * @param n index into the sequence
+ * @return the @p n th fibonacci number
+ */
+__attribute__((noinline)) uint64_t isolate_bench_entry(uint32_t n) {
+  if (n < 2)
+    return n;
+  return isolate_bench_entry(n - 1) + isolate_bench_entry(n - 2);
+}
+
+int main(void) {
+  volatile uint64_t sink = 0;
+  for (;;)
+    sink = isolate_bench_entry(24 + (uint32_t)(sink & 1));
+}
@@ -0,0 +1,32 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static char g_buf[4096];
+
+/**
+ * @brief formats, scans and hashes a string through libc
+ *
+ * isolate doesn't step past the breakpoint yet, so this body never runs. Today
+ * this target exercises one thread, a small address space and no setup before
+ * the first call; it is here so calls out of the main binary are covered once
+ * isolate can step past the breakpoint.
+ * @param n number of fields to format into the buffer
+ * @return a hash of the resulting string
+ */
+__attribute__((noinline)) uint64_t isolate_bench_entry(uint32_t n) {
+  size_t len = 0;
+  for (uint32_t i = 0; i < n && len < sizeof(g_buf) - 32; i++)
+    len += snprintf(g_buf + len, sizeof(g_buf) - len, "field%u=%x;", i, i * 2654435761u);
+
+  uint64_t hash = 1469598103934665603ull;
+  for (const char* p = g_buf; (p = strchr(p, ';')) != NULL; p++)
+    hash = (hash ^ (uint64_t)(p - g_buf)) * 1099511628211ull;
+  return hash ^ strlen(g_buf);
+}
+
+int main(void) {
+  volatile uint64_t sink = 0;
+  for (;;)
+    sink = isolate_bench_entry(64 + (uint32_t)(sink & 1));
+}
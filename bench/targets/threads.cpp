@@ -0,0 +1,34 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+const int g_num_threads = 16;
+
+atomic<uint64_t> g_sink{0};
+
+/**
+ * @brief small shared-state update called concurrently from every thread, so
+ *        breakpoints arrive from many threads of the task at once
+ * @param x value to fold into the shared counter
+ * @return the previous counter value
+ */
+extern "C" __attribute__((noinline)) uint64_t isolate_bench_entry(uint32_t x) {
+  return g_sink.fetch_add(x * 2654435761u, memory_order_relaxed);
+}
+
+int main() {
+  vector<thread> threads;
+  for (int i = 0; i < g_num_threads; i++) {
+    threads.emplace_back([i]() {
+      for (uint32_t n = i;; n++)
+        isolate_bench_entry(n);
+    });
+  }
+
+  for (auto& t : threads)
+    t.join();
+  return 0;
+}
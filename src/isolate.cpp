@@ -14,6 +14,8 @@
 // TODO: linux support
 #if defined(__APPLE__)
 #include <mach/mach.h>
+#include <mach/mach_vm.h>
+#include <mach-o/loader.h>
 #include <sys/types.h>
 #include <sys/ptrace.h>
 #include "mach_exc_handlers.h"
@@ -71,6 +73,57 @@ int print_registers(mach_port_t thread) {
   return KERN_SUCCESS;
 }
 
+/**
+ * @brief finds the ASLR slide of the main executable mapped into a task
+ * @param task the task to inspect
+ * @param slide receives the runtime address of the executable's __TEXT segment
+ *        minus its link-time address
+ * @return Mach error code (or KERN_SUCCESS)
+ */
+int get_executable_slide(mach_port_t task, uint64_t* slide) {
+  mach_vm_address_t addr = 0;
+  mach_vm_size_t size = 0;
+  while (true) {
+    vm_region_basic_info_data_64_t info;
+    mach_msg_type_number_t info_count = VM_REGION_BASIC_INFO_COUNT_64;
+    mach_port_t object_name;
+    // fails with KERN_INVALID_ADDRESS once we walk past the last region
+    kern_return_t ret = mach_vm_region(task, &addr, &size, VM_REGION_BASIC_INFO_64, (vm_region_info_t)&info, &info_count, &object_name);
+    if (ret != KERN_SUCCESS)
+      return ret;
+
+    // the executable is the only image with filetype MH_EXECUTE (dyld is MH_DYLINKER)
+    mach_header_64 header;
+    mach_vm_size_t read_size = 0;
+    if ((info.protection & VM_PROT_READ) &&
+        mach_vm_read_overwrite(task, addr, sizeof(header), (mach_vm_address_t)&header, &read_size) == KERN_SUCCESS &&
+        read_size == sizeof(header) && header.magic == MH_MAGIC_64 && header.filetype == MH_EXECUTE) {
+      vector<uint8_t> commands(header.sizeofcmds);
+      ret = mach_vm_read_overwrite(task, addr + sizeof(header), header.sizeofcmds, (mach_vm_address_t)commands.data(), &read_size);
+      if (ret != KERN_SUCCESS)
+        return ret;
+
+      size_t offset = 0;
+      for (uint32_t i = 0; i < header.ncmds && offset + sizeof(load_command) <= commands.size(); i++) {
+        load_command* cmd = (load_command*)(commands.data() + offset);
+        if (cmd->cmdsize == 0)
+          break;
+        if (cmd->cmd == LC_SEGMENT_64 && offset + sizeof(segment_command_64) <= commands.size()) {
+          segment_command_64* segment = (segment_command_64*)cmd;
+          if (strncmp(segment->segname, SEG_TEXT, sizeof(segment->segname)) == 0) {
+            *slide = addr - segment->vmaddr;
+            return KERN_SUCCESS;
+          }
+        }
+        offset += cmd->cmdsize;
+      }
+      return KERN_FAILURE;
+    }
+
+    addr += size;
+  }
+}
+
 /**
  * @brief prompts the user for a choice on the terminal
  * @param choices a vector of choices
@@ -441,7 +494,18 @@ int main(int argc, char* argv[]) {
         exit(EXIT_FAILURE);
       }
 
-      // TODO: handle ASLR
+      // --function-address is the link-time address (e.g. from nm), so apply the ASLR slide
+      {
+        uint64_t slide = 0;
+        kern_return_t kr = get_executable_slide(target_task_port, &slide);
+        if (kr != KERN_SUCCESS) {
+          cerr << "failed to find executable slide: " << mach_error_string(kr) << endl;
+          exit(EXIT_FAILURE);
+        }
+        function_addr += slide;
+        cout << "slide: " << hex << slide << ", function address: " << function_addr << endl;
+      }
+
       // set the first byte of the function to brk #0x1
       {
         // save old instruction
@@ -12,6 +12,10 @@ extern "C" kern_return_t catch_mach_exception_raise(
   mach_msg_type_number_t num_codes)
 {
   cout << "i am in the exception handler" << endl;
+  // bench/bench.cpp keys on this line, keep it in sync
+  if (exception_type == EXC_BREAKPOINT)
+    cout << "[isolate] breakpoint hit" << endl;
+
   if (exception_type == EXC_SOFTWARE && codes[0] == EXC_SOFT_SIGNAL) {
     if (codes[2] == SIGSTOP)
       codes[2] = 0;